@@ -1,10 +1,15 @@
 #include <benchmark/benchmark.h>
 #include "apriori.hpp"
 #include "fpgrowth.hpp"
+#include "sampling.hpp"
+#include "lcm.hpp"
+#include "prefixspan.hpp"
+#include "output.hpp"
 #include "utils.hpp"
 #include <fstream>
 #include <random>
 #include <iostream>
+#include <sstream>
 
 // --- Helper: Generate a larger synthetic dataset ---
 void generate_synthetic_data(const std::string& filename, int num_transactions) {
@@ -16,7 +21,7 @@ void generate_synthetic_data(const std::string& filename, int num_transactions)
     std::uniform_int_distribution<int> champ_dist(1, 50); // 50 possible champions
 
     for (int i = 0; i < num_transactions; ++i) {
-        out << "G" << i << ",Team1,N,N,N,N,N,"; // Ignore bans for speed
+        out << "G" << i << ",Team1,None,None,None,None,None,"; // No bans ("None" is skipped by the loader)
         // Pick 5 random champs
         for (int p = 0; p < 5; ++p) {
             out << "Champ" << champ_dist(rng);
@@ -39,6 +44,18 @@ void SetupData() {
     }
 }
 
+// Bigger dataset for the threaded tree build (it only kicks in on large inputs)
+DataLoader* g_big_loader = nullptr;
+
+void SetupBigData() {
+    if (!g_big_loader) {
+        generate_synthetic_data("bench_big.csv", 200000); // 200k Games
+        g_big_loader = new DataLoader();
+        g_big_loader->load_data("bench_big.csv");
+        std::remove("bench_big.csv");
+    }
+}
+
 // Cleanup step
 void CleanupData() {
     if (g_loader) {
@@ -74,4 +91,113 @@ static void BM_FPGrowth(benchmark::State& state) {
 }
 BENCHMARK(BM_FPGrowth)->Unit(benchmark::kMillisecond);
 
+// --- Benchmark: FP-Growth thread scaling (arg = threads) ---
+static void BM_FPGrowthThreads(benchmark::State& state) {
+    if (!g_big_loader) SetupBigData();
+
+    FPGrowth miner((unsigned)state.range(0));
+    for (auto _ : state) {
+        // 1% support: every champion is frequent (each is in ~10% of games), so the
+        // tree holds ~200k real paths, while pairs (~0.8%) stay below it and mining is short
+        auto results = miner.run(g_big_loader->get_transactions(), 2000);
+        benchmark::DoNotOptimize(results);
+    }
+}
+BENCHMARK(BM_FPGrowthThreads)->Arg(1)->Arg(2)->Arg(4)->Arg(8)->Unit(benchmark::kMillisecond);
+
+// --- Benchmark: LCM (all frequent itemsets) ---
+static void BM_LCM(benchmark::State& state) {
+    if (!g_loader) SetupData();
+
+    LCM miner;
+    for (auto _ : state) {
+        auto results = miner.run(g_loader->get_transactions(), 50);
+        benchmark::DoNotOptimize(results);
+    }
+}
+BENCHMARK(BM_LCM)->Unit(benchmark::kMillisecond);
+
+// --- Benchmark: LCM (closed itemsets only) ---
+static void BM_LCMClosed(benchmark::State& state) {
+    if (!g_loader) SetupData();
+
+    LCM miner(LCM::Mode::Closed);
+    for (auto _ : state) {
+        auto results = miner.run(g_loader->get_transactions(), 50);
+        benchmark::DoNotOptimize(results);
+    }
+}
+BENCHMARK(BM_LCMClosed)->Unit(benchmark::kMillisecond);
+
+// --- Benchmark: Sampling (Toivonen) ---
+static void BM_Sampling(benchmark::State& state) {
+    if (!g_loader) SetupData();
+
+    // Sample half the games so the verification pass actually runs
+    SamplingMiner miner(500);
+    for (auto _ : state) {
+        auto results = miner.run(g_loader->get_transactions(), 50);
+        benchmark::DoNotOptimize(results);
+    }
+}
+BENCHMARK(BM_Sampling)->Unit(benchmark::kMillisecond);
+
+// --- Benchmark: PrefixSpan (draft-order sequences) ---
+static void BM_PrefixSpan(benchmark::State& state) {
+    if (!g_loader) SetupData();
+
+    PrefixSpan miner;
+    for (auto _ : state) {
+        // An ordered pair of picks shows up in ~4 of 1000 games, so at 5 about a third
+        // of them are frequent (at 50 only single champions would be)
+        auto results = miner.run(g_loader->get_sequences(), 5);
+        benchmark::DoNotOptimize(results);
+    }
+}
+BENCHMARK(BM_PrefixSpan)->Unit(benchmark::kMillisecond);
+
+// --- Benchmark: PrefixSpan on 200k games (pseudo-projection at scale) ---
+static void BM_PrefixSpanBig(benchmark::State& state) {
+    if (!g_big_loader) SetupBigData();
+
+    PrefixSpan miner;
+    for (auto _ : state) {
+        // 0.25%: every ordered pair of picks (~0.4% each) is frequent, triples are not
+        auto results = miner.run(g_big_loader->get_sequences(), 500);
+        benchmark::DoNotOptimize(results);
+    }
+}
+BENCHMARK(BM_PrefixSpanBig)->Unit(benchmark::kMillisecond);
+
+// --- Benchmark: Result export (NDJSON vs binary) ---
+static void BM_WriteNDJSON(benchmark::State& state) {
+    if (!g_loader) SetupData();
+
+    LCM miner;
+    auto patterns = miner.run(g_loader->get_transactions(), 5); // low support = many patterns
+    NameTable names(*g_loader);
+    for (auto _ : state) {
+        std::ostringstream out;
+        write_ndjson(patterns, names, out);
+        benchmark::DoNotOptimize(out);
+    }
+    state.SetItemsProcessed(state.iterations() * patterns.size());
+}
+BENCHMARK(BM_WriteNDJSON)->Unit(benchmark::kMillisecond);
+
+static void BM_WriteBinary(benchmark::State& state) {
+    if (!g_loader) SetupData();
+
+    LCM miner;
+    auto patterns = miner.run(g_loader->get_transactions(), 5);
+    NameTable names(*g_loader);
+    for (auto _ : state) {
+        std::ostringstream out;
+        write_binary(patterns, names, out);
+        benchmark::DoNotOptimize(out);
+    }
+    state.SetItemsProcessed(state.iterations() * patterns.size());
+}
+BENCHMARK(BM_WriteBinary)->Unit(benchmark::kMillisecond);
+
 BENCHMARK_MAIN();
\ No newline at end of file
@@ -13,31 +13,44 @@ struct FPNode {
     int count;
     std::weak_ptr<FPNode> parent; // Weak pointer to avoid cycles
     std::vector<std::shared_ptr<FPNode>> children;
-    std::shared_ptr<FPNode> next_link; // For the header table (linked list of same items)
+    FPNode* next_link; // For the header table (linked list of same items); non-owning, 'children' owns nodes
 
     FPNode(int item, std::shared_ptr<FPNode> p) : item_id(item), count(1), parent(p), next_link(nullptr) {}
 };
 
 class FPGrowth {
 public:
+    // num_threads: threads used to build large trees (0 = one per hardware core)
+    explicit FPGrowth(unsigned num_threads = 0);
+
     // Main Entry Point
     std::vector<Pattern> run(const std::vector<Transaction>& transactions, int min_sup_count);
 
 private:
     int min_sup;
+    unsigned num_threads;
     std::vector<Pattern> frequent_patterns;
 
     // helperss
     
     // Build the main FP-Tree from transactions
+    // Large inputs are built in parallel: transactions are grouped by their leading
+    // (most frequent) items, each group fills its own disjoint subtree, and header chains
+    // are relinked in serial creation order, so the tree is identical to a serial build.
     std::shared_ptr<FPNode> build_tree(const std::vector<Transaction>& transactions, 
                                        const std::map<int, int>& global_freq_items,
-                                       std::map<int, std::shared_ptr<FPNode>>& header_table);
+                                       std::map<int, FPNode*>& header_table);
+
+    // Parallel part of build_tree (rank: item ID -> frequency rank, -1 = infrequent)
+    void build_subtrees_parallel(const std::vector<Transaction>& transactions,
+                                 const std::vector<int>& rank, const std::vector<int>& rank_to_item,
+                                 const std::shared_ptr<FPNode>& root,
+                                 std::map<int, FPNode*>& header_table);
 
     // Recursive Miner (The "Growth" phase)
     // mines the tree rooted at 'tree_root' for specific conditional patterns
     void mine_tree(std::shared_ptr<FPNode> tree_root, 
-                   std::map<int, std::shared_ptr<FPNode>>& header_table, 
+                   std::map<int, FPNode*>& header_table, 
                    std::set<int> current_suffix);
 
     // Find global frequency of single items (L1) - reuse logic effectively
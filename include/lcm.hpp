@@ -0,0 +1,70 @@
+#pragma once
+
+#include "utils.hpp"
+#include "apriori.hpp" // We re-use the Pattern struct
+#include <vector>
+#include <set>
+
+// LCM-style miner (Linear time Closed itemset Miner, Uno et al.)
+// - One flat database: rows are ranges of a single item buffer with a weight,
+//   and occurrence lists are arrays of row indices into it.
+// - Occurrence deliver: one sweep over the occurrences of P fills the
+//   occurrence lists of every extension P+e at once (into reused buffers).
+// - Database reduction: items are renamed to frequency ranks, infrequent items
+//   dropped and identical rows merged into one weighted row (hash buckets, no sort).
+//   Below the root this only happens once an occurrence list has shrunk enough
+//   for the copy to pay off; reduced rows live on top of the buffer and are
+//   popped when the branch is done.
+// - All mode returns every frequent itemset (same output as Apriori/FPGrowth),
+//   Closed mode only the closed ones via prefix-preserving closure extension.
+class LCM {
+public:
+    enum class Mode { All, Closed };
+
+    explicit LCM(Mode mode = Mode::All) : mode(mode) {}
+
+    // Main Entry Point
+    std::vector<Pattern> run(const std::vector<Transaction>& transactions, int min_sup_count);
+
+private:
+    // Scratch space for one recursion depth, reused by every node at that depth
+    struct Level {
+        std::vector<std::vector<int>> occ; // item rank -> rows containing prefix+item
+        std::vector<int> support;          // item rank -> weighted support
+        std::vector<int> touched;          // ranks with a non-empty occ list
+        std::vector<int> reduced;          // occ list after a reduction
+    };
+
+    Mode mode;
+    int min_sup;
+    std::vector<Pattern> frequent_patterns;
+    std::vector<int> rank_to_item; // rank -> original champion ID (rank 0 = most frequent)
+
+    // Flat database: row r is items[row_start[r] .. row_start[r] + row_len[r]), ascending ranks
+    std::vector<int> items;
+    std::vector<size_t> row_start;
+    std::vector<int> row_len;
+    std::vector<int> weight;
+
+    std::vector<Level> levels;
+    std::vector<int> counts;        // item rank -> scratch count, kept all-zero between uses
+    std::vector<int> hash_table;    // scratch for duplicate detection
+
+    // Occurrence deliver for the rows in 'occ', items ranked above 'tail', into levels[depth]
+    void deliver(const std::vector<int>& occ, int tail, size_t depth);
+
+    // Append the part of each row in 'occ' after 'e' (frequent items only) as new rows,
+    // merging duplicates. The new row indices go to 'out'.
+    void reduce(const std::vector<int>& occ, int e, std::vector<int>& out);
+
+    // All mode: 'occ' holds the rows containing 'prefix'; extensions must rank above 'tail'.
+    // 'reduced_at' is the occurrence count at the last reduction on this path.
+    void mine_all(const std::vector<int>& occ, int tail, size_t depth,
+                  std::vector<int>& prefix, size_t reduced_at);
+
+    // Closed mode: 'closed' is a closed itemset (sorted ranks), 'core' the item that
+    // generated it and 'occ' the rows containing it.
+    void mine_closed(const std::vector<int>& closed, int core, const std::vector<int>& occ, size_t depth);
+
+    void emit(const std::vector<int>& ranks, int support);
+};
@@ -0,0 +1,38 @@
+#pragma once
+
+#include "utils.hpp"
+#include "apriori.hpp" // We re-use the Pattern struct
+#include "prefixspan.hpp"
+#include <vector>
+#include <string>
+#include <ostream>
+
+// Champion names interned once per run, indexed by ID.
+// Each name is also stored pre-escaped as a JSON string, so writers just append bytes.
+class NameTable {
+public:
+    explicit NameTable(const DataLoader& loader);
+
+    const std::string& name(int id) const;
+    const std::string& json(int id) const; // quoted + escaped, e.g. "\"Lee Sin\""
+    size_t size() const { return names.size(); }
+
+private:
+    std::vector<std::string> names;
+    std::vector<std::string> json_names;
+};
+
+// One JSON object per line:
+// {"support":123,"ids":[4,17],"names":["Ahri","Lee Sin"]}
+// For sequences, "ids"/"names" are in draft order instead of sorted.
+void write_ndjson(const std::vector<Pattern>& patterns, const NameTable& names, std::ostream& out);
+void write_ndjson(const std::vector<SequencePattern>& patterns, const NameTable& names, std::ostream& out);
+
+// Compact binary dump (little-endian):
+//   "DDPT"              magic ("DDSQ" for sequences, whose IDs are in draft order)
+//   uint32 version      (1)
+//   uint32 name_count   then name_count x { uint16 length, bytes }  (index = champion ID)
+//   uint64 pattern_count
+//   per pattern:        uint32 support, uint16 size, size x uint32 champion ID
+void write_binary(const std::vector<Pattern>& patterns, const NameTable& names, std::ostream& out);
+void write_binary(const std::vector<SequencePattern>& patterns, const NameTable& names, std::ostream& out);
@@ -0,0 +1,45 @@
+#pragma once
+
+#include "utils.hpp"
+#include <vector>
+#include <cstdint>
+
+// Represents a discovered sequential pattern, e.g. [Ahri -> Lee Sin]
+struct SequencePattern {
+    std::vector<int> items; // Champion IDs in draft order (not sorted)
+    int support;            // Number of sequences containing it as a subsequence
+};
+
+// PrefixSpan (Pei et al.) over single-champion events.
+// Sequences are flattened once into one contiguous buffer (infrequent champions dropped).
+// Projected databases are pseudo-projections: (sequence, suffix offset) pairs into that
+// buffer, so nothing is copied while growing prefixes.
+class PrefixSpan {
+public:
+    // max_length: longest pattern to grow (0 = no limit)
+    explicit PrefixSpan(size_t max_length = 0) : max_length(max_length) {}
+
+    // Main Entry Point (same threshold contract as the itemset miners)
+    std::vector<SequencePattern> run(const std::vector<Sequence>& sequences, int min_sup_count);
+
+private:
+    // Suffix flat[pos .. seq_end[seq]) of sequence 'seq'
+    struct Projection {
+        uint32_t seq;
+        uint32_t pos;
+    };
+
+    size_t max_length;
+    int min_sup;
+    std::vector<SequencePattern> frequent_patterns;
+
+    std::vector<int> flat;          // all sequences back to back
+    std::vector<uint32_t> seq_end;  // end offset of each sequence in 'flat'
+
+    // Per-item "last counted in projection #" marks, so each sequence counts an item once
+    std::vector<uint64_t> seen;
+    uint64_t epoch = 0;
+
+    // Grow 'prefix' by every item frequent in 'projected', recursing on each
+    void mine(const std::vector<Projection>& projected, std::vector<int>& prefix);
+};
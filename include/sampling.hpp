@@ -0,0 +1,72 @@
+#pragma once
+
+#include "utils.hpp"
+#include "apriori.hpp" // We re-use the Pattern struct
+#include <vector>
+#include <set>
+#include <cstddef>
+#include <cstdint>
+
+// Summary of the last run: how much was verified and whether the sample missed anything.
+// The result itself is always exact (misses are repaired by extra counting passes).
+struct SamplingReport {
+    size_t sample_size = 0;       // Transactions drawn into the in-memory sample
+    int sample_min_sup = 0;       // Lowered threshold used on the sample
+    size_t candidates = 0;        // Sample-frequent itemsets verified on the full data
+    size_t border_size = 0;       // Negative border itemsets verified on the full data
+    size_t border_failures = 0;   // Border itemsets that turned out frequent (misses possible)
+    size_t extra_passes = 0;      // Counting passes needed after a miss to complete the result
+};
+
+// Toivonen-style sampling miner.
+// 1. Mine a random sample at a lowered support.
+// 2. Count those itemsets plus their negative border over the full data: one scan for
+//    singletons and pairs, per-item transaction bitsets intersected for larger itemsets.
+// 3. If no border itemset is frequent, the result is complete. Otherwise count the new
+//    border of the (now larger) frequent collection, and repeat until nothing new is
+//    frequent. Each extra pass only intersects bitsets for the new border itemsets.
+class SamplingMiner {
+public:
+    // sample_size: number of transactions to hold in memory (whole dataset if it's smaller).
+    // slack: multiplier (< 1) on the scaled threshold to lower the chance of a miss.
+    // num_threads: passed to the FP-Growth runs (0 = one per hardware core)
+    explicit SamplingMiner(size_t sample_size = 20000, double slack = 0.8, unsigned seed = 42,
+                           unsigned num_threads = 0)
+        : sample_size(sample_size), slack(slack), seed(seed), num_threads(num_threads) {}
+
+    // Main Entry Point (same contract as Apriori/FPGrowth)
+    std::vector<Pattern> run(const std::vector<Transaction>& transactions, int min_sup_count);
+
+    const SamplingReport& get_last_report() const { return report; }
+
+private:
+    size_t sample_size;
+    double slack;
+    unsigned seed;
+    unsigned num_threads;
+    int min_sup;
+    SamplingReport report;
+
+    // Step 1: uniform sample without replacement (partial Fisher-Yates over indices)
+    std::vector<Transaction> draw_sample(const std::vector<Transaction>& transactions);
+
+    // Step 2: itemsets not in 'frequent' whose immediate subsets all are (Bd-)
+    // (singletons are left to the full item count in run(), which also sees unsampled items)
+    std::vector<std::set<int>> negative_border(const std::vector<Pattern>& frequent);
+
+    // Step 3: support of every candidate on the full data.
+    // Also fills single_counts (indexed by item ID) for the singleton border check.
+    std::vector<int> count_supports(const std::vector<Transaction>& transactions,
+                                    const std::vector<std::set<int>>& candidates,
+                                    std::vector<int>& single_counts);
+
+    // item ID -> bitset of the transactions containing it (empty if not built yet)
+    std::vector<std::vector<uint64_t>> item_bits;
+
+    // Build the bitsets still missing for the items of 'candidates' (one scan)
+    void build_item_bits(const std::vector<Transaction>& transactions,
+                         const std::vector<std::set<int>>& candidates);
+
+    // Supports of itemsets of size >= 2 by intersecting item_bits along a prefix trie
+    std::vector<int> count_with_bits(const std::vector<std::set<int>>& candidates);
+};
@@ -0,0 +1,33 @@
+#pragma once
+
+#include "utils.hpp"
+#include <vector>
+#include <functional>
+#include <algorithm>
+#include <cstddef>
+
+// Top-K by support on top of any threshold miner (itemsets or sequences).
+// There is no threshold that gives exactly K patterns up front, so we start from a
+// guess and halve it until at least K come back. Once that happens, every pattern
+// with support >= the K-th support has been found, so cutting to K is exact.
+
+// Starting guess: the K-th highest single-item count. Every single item is itself a
+// frequent itemset (and a one-champion sequence), so this is usually enough in one run.
+// It falls short for closed itemsets (a single item need not be closed) and when K
+// is larger than the number of distinct items.
+int top_k_threshold(const std::vector<Transaction>& transactions, int k);
+
+// Runs 'mine' (threshold -> number of patterns found) from 'start' and halves the
+// threshold until at least k patterns come back or it reaches 1.
+// Returns the threshold of the last run.
+int mine_top_k(int start, int k, const std::function<size_t(int)>& mine);
+
+// Highest support first, item order as a stable tie-breaker; keeps at most k
+template <typename P>
+void rank_top_k(std::vector<P>& patterns, int k) {
+    std::sort(patterns.begin(), patterns.end(), [](const P& a, const P& b) {
+        if (a.support != b.support) return a.support > b.support;
+        return a.items < b.items;
+    });
+    if ((int)patterns.size() > k) patterns.resize(k);
+}
@@ -12,6 +12,12 @@ struct Transaction {
     std::vector<int> items; // Sorted list of Champion IDs
 };
 
+// A "Sequence" is the same team row, but in column (draft) order, e.g. ban1..ban5, pick1..pick5.
+// Used by the sequential miner, where first-pick vs. counter-pick order matters.
+struct Sequence {
+    std::vector<int> items; // Champion IDs in column order (no repeats)
+};
+
 class DataLoader {
 public:
     // Load CSV from file_path.
@@ -21,15 +27,22 @@ public:
     // Get the list of all transactions processed
     const std::vector<Transaction>& get_transactions() const;
 
+    // Same rows in column order (shares the champion dictionary with transactions)
+    const std::vector<Sequence>& get_sequences() const;
+
     // Mapping helpers
     int get_champion_id(const std::string& name);
     std::string get_champion_name(int id) const;
+
+    // All names indexed by ID (index 0 = "Unknown"), for bulk output without per-item lookups
+    std::vector<std::string> get_name_table() const;
     
     // Debug helper
     void print_stats() const;
 
 private:
     std::vector<Transaction> transactions;
+    std::vector<Sequence> sequences;
     
     // Bi-directional mapping: Name <-> ID
     std::map<std::string, int> name_to_id;
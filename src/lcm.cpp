@@ -0,0 +1,288 @@
+#include "lcm.hpp"
+#include <algorithm>
+
+// Reduce below the root once an occurrence list has shrunk to this fraction
+// of the rows at the last reduction; above it the copy would barely shrink the
+// branch's database.
+static const size_t REDUCE_NUM = 3, REDUCE_DEN = 4;
+
+namespace {
+
+// Open-addressing table of row indices keyed by row contents
+struct RowBuckets {
+    std::vector<int>& slots;
+    size_t mask;
+
+    RowBuckets(std::vector<int>& storage, size_t expected) : slots(storage) {
+        size_t cap = 16;
+        while (cap < expected * 2) cap <<= 1;
+        slots.assign(cap, -1);
+        mask = cap - 1;
+    }
+
+    static size_t hash(const int* first, int len) {
+        size_t h = 14695981039346656037ull; // FNV-1a over the ranks
+        for (int i = 0; i < len; ++i) {
+            h ^= (size_t)first[i];
+            h *= 1099511628211ull;
+        }
+        return h;
+    }
+};
+
+} // namespace
+
+std::vector<Pattern> LCM::run(const std::vector<Transaction>& transactions, int min_sup_count) {
+    this->min_sup = min_sup_count;
+    frequent_patterns.clear();
+    rank_to_item.clear();
+    items.clear();
+    row_start.clear();
+    row_len.clear();
+    weight.clear();
+
+    // 1. Global item counts (IDs are small and dense)
+    std::vector<int> item_counts;
+    for (const auto& t : transactions) {
+        for (int item : t.items) {
+            if (item >= (int)item_counts.size()) item_counts.resize(item + 1, 0);
+            item_counts[item]++;
+        }
+    }
+
+    // 2. Rename frequent items to ranks: most frequent first, ID as tie-breaker.
+    // Extensions only add higher ranks, so conditional databases hold the rare tail.
+    for (int item = 0; item < (int)item_counts.size(); ++item) {
+        if (item_counts[item] >= min_sup) rank_to_item.push_back(item);
+    }
+    std::sort(rank_to_item.begin(), rank_to_item.end(), [&](int a, int b) {
+        if (item_counts[a] != item_counts[b]) return item_counts[a] > item_counts[b];
+        return a < b;
+    });
+    std::vector<int> item_to_rank(item_counts.size(), -1);
+    for (int r = 0; r < (int)rank_to_item.size(); ++r) item_to_rank[rank_to_item[r]] = r;
+
+    size_t num_items = rank_to_item.size();
+    counts.assign(num_items, 0);
+
+    // 3. Reduced root database: ranked rows, identical rows merged into weights
+    std::vector<int> root;
+    RowBuckets buckets(hash_table, transactions.size());
+    size_t max_len = 0;
+    for (const auto& t : transactions) {
+        size_t start = items.size();
+        for (int item : t.items) {
+            if (item_to_rank[item] >= 0) items.push_back(item_to_rank[item]);
+        }
+        int len = (int)(items.size() - start);
+        if (len == 0) continue;
+        std::sort(items.begin() + start, items.end());
+
+        size_t slot = RowBuckets::hash(&items[start], len) & buckets.mask;
+        bool merged = false;
+        while (buckets.slots[slot] >= 0) {
+            int r = buckets.slots[slot];
+            if (row_len[r] == len && std::equal(items.begin() + start, items.end(), items.begin() + row_start[r])) {
+                weight[r]++;
+                merged = true;
+                break;
+            }
+            slot = (slot + 1) & buckets.mask;
+        }
+        if (merged) {
+            items.resize(start);
+            continue;
+        }
+        buckets.slots[slot] = (int)row_start.size();
+        root.push_back((int)row_start.size());
+        row_start.push_back(start);
+        row_len.push_back(len);
+        weight.push_back(1);
+        max_len = std::max(max_len, (size_t)len);
+    }
+
+    // One scratch level per possible depth (a pattern can't outgrow the longest row)
+    levels.assign(max_len + 2, Level{});
+    for (auto& level : levels) {
+        level.occ.resize(num_items);
+        level.support.assign(num_items, 0);
+    }
+
+    // 4. Mine
+    if (mode == Mode::All) {
+        std::vector<int> prefix;
+        mine_all(root, -1, 0, prefix, root.size());
+    } else {
+        // Root closed set: items present in every row (usually empty)
+        int total = 0;
+        for (int t : root) {
+            total += weight[t];
+            for (int k = 0; k < row_len[t]; ++k) counts[items[row_start[t] + k]] += weight[t];
+        }
+        std::vector<int> closed;
+        for (int r = 0; r < (int)num_items; ++r) {
+            if (counts[r] == total) closed.push_back(r);
+            counts[r] = 0;
+        }
+        if (!closed.empty() && total >= min_sup) emit(closed, total);
+        mine_closed(closed, -1, root, 0);
+    }
+    return frequent_patterns;
+}
+
+void LCM::deliver(const std::vector<int>& occ, int tail, size_t depth) {
+    Level& level = levels[depth];
+    for (int t : occ) {
+        size_t begin = row_start[t];
+        size_t end = begin + row_len[t];
+        size_t k = std::upper_bound(items.begin() + begin, items.begin() + end, tail) - items.begin();
+        for (; k < end; ++k) {
+            int r = items[k];
+            if (level.occ[r].empty()) level.touched.push_back(r);
+            level.occ[r].push_back(t);
+            level.support[r] += weight[t];
+        }
+    }
+    std::sort(level.touched.begin(), level.touched.end());
+}
+
+void LCM::reduce(const std::vector<int>& occ, int e, std::vector<int>& out) {
+    out.clear();
+
+    // Which items are still frequent below prefix+e
+    std::vector<int> seen;
+    for (int t : occ) {
+        size_t begin = row_start[t];
+        size_t end = begin + row_len[t];
+        size_t k = std::upper_bound(items.begin() + begin, items.begin() + end, e) - items.begin();
+        for (; k < end; ++k) {
+            if (counts[items[k]] == 0) seen.push_back(items[k]);
+            counts[items[k]] += weight[t];
+        }
+    }
+
+    RowBuckets buckets(hash_table, occ.size());
+    for (int t : occ) {
+        size_t begin = row_start[t];
+        size_t end = begin + row_len[t];
+        size_t k = std::upper_bound(items.begin() + begin, items.begin() + end, e) - items.begin();
+        size_t start = items.size();
+        for (; k < end; ++k) {
+            if (counts[items[k]] >= min_sup) items.push_back(items[k]); // index access: push_back may reallocate
+        }
+        int len = (int)(items.size() - start);
+        if (len == 0) continue;
+
+        size_t slot = RowBuckets::hash(&items[start], len) & buckets.mask;
+        bool merged = false;
+        while (buckets.slots[slot] >= 0) {
+            int r = buckets.slots[slot];
+            if (row_len[r] == len && std::equal(items.begin() + start, items.end(), items.begin() + row_start[r])) {
+                weight[r] += weight[t];
+                merged = true;
+                break;
+            }
+            slot = (slot + 1) & buckets.mask;
+        }
+        if (merged) {
+            items.resize(start);
+            continue;
+        }
+        buckets.slots[slot] = (int)row_start.size();
+        out.push_back((int)row_start.size());
+        row_start.push_back(start);
+        row_len.push_back(len);
+        weight.push_back(weight[t]);
+    }
+
+    for (int r : seen) counts[r] = 0;
+}
+
+void LCM::mine_all(const std::vector<int>& occ, int tail, size_t depth,
+                   std::vector<int>& prefix, size_t reduced_at) {
+    deliver(occ, tail, depth);
+    Level& level = levels[depth];
+
+    for (int e : level.touched) {
+        int support = level.support[e];
+        if (support < min_sup) continue;
+
+        prefix.push_back(e);
+        emit(prefix, support);
+
+        std::vector<int>& occ_e = level.occ[e];
+        if (occ_e.size() * REDUCE_DEN <= reduced_at * REDUCE_NUM) {
+            // Reduced rows go on top of the buffer and are popped after the branch
+            size_t item_mark = items.size();
+            size_t row_mark = row_start.size();
+            reduce(occ_e, e, level.reduced);
+            if (!level.reduced.empty()) {
+                mine_all(level.reduced, e, depth + 1, prefix, level.reduced.size());
+            }
+            items.resize(item_mark);
+            row_start.resize(row_mark);
+            row_len.resize(row_mark);
+            weight.resize(row_mark);
+        } else {
+            mine_all(occ_e, e, depth + 1, prefix, reduced_at);
+        }
+        prefix.pop_back();
+    }
+
+    // Leave this level's buffers empty (capacity kept) for the next node at this depth
+    for (int e : level.touched) {
+        level.occ[e].clear();
+        level.support[e] = 0;
+    }
+    level.touched.clear();
+}
+
+void LCM::mine_closed(const std::vector<int>& closed, int core, const std::vector<int>& occ, size_t depth) {
+    deliver(occ, core, depth);
+    Level& level = levels[depth];
+
+    for (int e : level.touched) {
+        int support = level.support[e];
+        if (support < min_sup) continue;
+        if (std::binary_search(closed.begin(), closed.end(), e)) continue;
+
+        // Closure of closed+e: items present in every occurrence
+        const std::vector<int>& occ_e = level.occ[e];
+        for (int t : occ_e) {
+            for (int k = 0; k < row_len[t]; ++k) counts[items[row_start[t] + k]] += weight[t];
+        }
+        // Every closure item is in the first occurrence, so read the candidates from there
+        std::vector<int> next;
+        bool prefix_preserving = true;
+        int first = occ_e.front();
+        for (int k = 0; k < row_len[first]; ++k) {
+            int r = items[row_start[first] + k];
+            if (counts[r] != support) continue;
+            next.push_back(r);
+            // An item before e that wasn't already there means this closed set
+            // is reached from another (earlier) parent: skip it here.
+            if (r < e && !std::binary_search(closed.begin(), closed.end(), r)) {
+                prefix_preserving = false;
+            }
+        }
+        for (int t : occ_e) {
+            for (int k = 0; k < row_len[t]; ++k) counts[items[row_start[t] + k]] = 0;
+        }
+
+        if (!prefix_preserving) continue;
+        emit(next, support);
+        mine_closed(next, e, occ_e, depth + 1);
+    }
+
+    for (int e : level.touched) {
+        level.occ[e].clear();
+        level.support[e] = 0;
+    }
+    level.touched.clear();
+}
+
+void LCM::emit(const std::vector<int>& ranks, int support) {
+    std::set<int> pattern;
+    for (int r : ranks) pattern.insert(rank_to_item[r]);
+    frequent_patterns.push_back({ pattern, support });
+}
@@ -3,9 +3,16 @@
 #include <vector>
 #include <chrono> 
 #include <algorithm> // ADDED FOR SORTING
+#include <fstream>
+#include <cstring>
 #include "utils.hpp"
 #include "apriori.hpp"
 #include "fpgrowth.hpp"
+#include "sampling.hpp"
+#include "lcm.hpp"
+#include "prefixspan.hpp"
+#include "output.hpp"
+#include "topk.hpp"
 
 void print_header() {
     std::cout << "\n-------------------------------------------\n";
@@ -77,6 +84,83 @@ void run_fpgrowth(DataLoader& loader) {
     print_top_patterns(patterns, loader);
 }
 
+void run_sampling(DataLoader& loader) {
+    if (loader.get_transactions().empty()) return;
+    int min_sup = get_threshold(loader);
+    std::cout << "Mining a sample, then verifying on the full data (Support: " << min_sup << ")... \n";
+
+    auto start = std::chrono::high_resolution_clock::now();
+    SamplingMiner miner;
+    auto patterns = miner.run(loader.get_transactions(), min_sup);
+    auto end = std::chrono::high_resolution_clock::now();
+
+    std::chrono::duration<double, std::milli> elapsed = end - start;
+    const SamplingReport& r = miner.get_last_report();
+    std::cout << "Done! Found " << patterns.size() << " patterns in " << elapsed.count() << " ms.\n";
+    std::cout << "  Sample: " << r.sample_size << " transactions at support " << r.sample_min_sup << "\n";
+    std::cout << "  Verified: " << r.candidates << " candidates + " << r.border_size << " border itemsets\n";
+    if (r.extra_passes > 0) {
+        std::cout << "  Result: exact (sample missed " << r.border_failures << " border itemsets, "
+                  << r.extra_passes << " extra counting passes)\n";
+    } else {
+        std::cout << "  Result: exact (no border itemset was frequent)\n";
+    }
+
+    print_top_patterns(patterns, loader);
+}
+
+// Sequences keep draft order, so print them as a chain
+void print_top_sequences(const std::vector<SequencePattern>& patterns, const DataLoader& loader) {
+    std::vector<SequencePattern> sorted = patterns;
+    std::sort(sorted.begin(), sorted.end(), [](const SequencePattern& a, const SequencePattern& b) {
+        return a.support > b.support;
+    });
+
+    std::cout << "\n--- Top Draft Sequences (Highest Support) ---\n";
+    int count = 0;
+    for (const auto& p : sorted) {
+        if (p.items.size() >= 2) {
+            std::cout << "[ ";
+            for (size_t i = 0; i < p.items.size(); ++i) {
+                if (i > 0) std::cout << "-> ";
+                std::cout << loader.get_champion_name(p.items[i]) << " ";
+            }
+            std::cout << "] : " << p.support << "\n";
+            count++;
+        }
+        if (count >= 10) break;
+    }
+}
+
+void run_prefixspan(DataLoader& loader) {
+    if (loader.get_sequences().empty()) return;
+    int min_sup = get_threshold(loader);
+    std::cout << "Mining draft-order sequences with PrefixSpan (Support: " << min_sup << ")... \n";
+
+    auto start = std::chrono::high_resolution_clock::now();
+    PrefixSpan miner;
+    auto patterns = miner.run(loader.get_sequences(), min_sup);
+    auto end = std::chrono::high_resolution_clock::now();
+
+    std::chrono::duration<double, std::milli> elapsed = end - start;
+    std::cout << "Done! Found " << patterns.size() << " sequences in " << elapsed.count() << " ms.\n";
+
+    print_top_sequences(patterns, loader);
+}
+
+// Compares full result sets (items + support), not just how many patterns were found.
+// Miners emit patterns in different orders, so both sides are put in item order first.
+bool same_patterns(std::vector<Pattern> a, std::vector<Pattern> b) {
+    if (a.size() != b.size()) return false;
+    auto by_items = [](const Pattern& x, const Pattern& y) { return x.items < y.items; };
+    std::sort(a.begin(), a.end(), by_items);
+    std::sort(b.begin(), b.end(), by_items);
+    for (size_t i = 0; i < a.size(); ++i) {
+        if (a[i].items != b[i].items || a[i].support != b[i].support) return false;
+    }
+    return true;
+}
+
 void run_race(DataLoader& loader) {
     if (loader.get_transactions().empty()) return;
     std::cout << "\n--- ALGORITHM RACE MODE ---\n";
@@ -100,26 +184,229 @@ void run_race(DataLoader& loader) {
     std::chrono::duration<double, std::milli> t2 = end2 - start2;
     std::cout << t2.count() << " ms.\n";
 
-    // Validation step for algos
+    // LCM
+    std::cout << "3. Running LCM... ";
+    auto start3 = std::chrono::high_resolution_clock::now();
+    LCM lcm;
+    auto p3 = lcm.run(loader.get_transactions(), min_sup);
+    auto end3 = std::chrono::high_resolution_clock::now();
+    std::chrono::duration<double, std::milli> t3 = end3 - start3;
+    std::cout << t3.count() << " ms.\n";
+
+    // Validation step for algos: every pattern and its support must agree
     std::cout << "\n VALIDATION \n";
-    if (p1.size() == p2.size()) {
-        std::cout << "[SUCCESS] Both algorithms found exactly " << p1.size() << " patterns.\n";
+    bool fp_ok = same_patterns(p1, p2);
+    bool lcm_ok = same_patterns(p1, p3);
+    if (fp_ok && lcm_ok) {
+        std::cout << "[SUCCESS] All algorithms found the same " << p1.size() << " patterns.\n";
     } else {
-        std::cout << "[WARNING] Discrepancy detected! (" << p1.size() << " vs " << p2.size() << ")\n";
+        if (!fp_ok) std::cout << "[WARNING] Apriori vs FP-Growth mismatch! (" << p1.size() << " vs " << p2.size() << " patterns)\n";
+        if (!lcm_ok) std::cout << "[WARNING] Apriori vs LCM mismatch! (" << p1.size() << " vs " << p3.size() << " patterns)\n";
     }
     
     // Result
-    if (t2.count() > 0.0) {
-        std::cout << "\n>>> Speedup: FP-Growth was " << (t1.count() / t2.count()) << "x faster.\n";
+    if (t2.count() > 0.0 && t3.count() > 0.0) {
+        std::cout << "\n>>> Speedup: FP-Growth was " << (t1.count() / t2.count()) << "x faster than Apriori.\n";
+        std::cout << ">>> Speedup: LCM was " << (t1.count() / t3.count()) << "x faster than Apriori.\n";
     } else {
-        std::cout << "\n>>> Speedup: FP-Growth finished too quickly to measure reliably.\n";
+        std::cout << "\n>>> Speedup: FP-Growth/LCM finished too quickly to measure reliably.\n";
     }
 
-    // Both will now print identical top lists
+    // All will now print identical top lists
     print_top_patterns(p2, loader);
 }
 
+// --- Batch mode (non-interactive) ---
+
+void print_usage() {
+    std::cerr << "Usage: draft-doctor [data.csv]              (interactive menu)\n"
+              << "       draft-doctor --data FILE [options]   (batch)\n"
+              << "       draft-doctor FILE [options]          (batch, same as --data FILE)\n"
+              << "\nBatch options:\n"
+              << "  --data FILE        CSV with pick/ban columns (required)\n"
+              << "  --algo NAME        apriori | fpgrowth | lcm | lcm-closed | sampling | prefixspan\n"
+              << "                     (default: fpgrowth; prefixspan mines draft-order sequences)\n"
+              << "  --support PCT      minimum support in percent (default: 1)\n"
+              << "  --min-count N      minimum support as an absolute count\n"
+              << "  --top-k K          keep only the K patterns with the highest support\n"
+              << "  --threads N        threads for FP-Growth tree building, also inside sampling\n"
+              << "                     (default: 0 = all cores)\n"
+              << "  --out FILE         output path, '-' for stdout (default: -)\n"
+              << "  --format FMT       ndjson | bin (default: ndjson)\n";
+}
+
+struct BatchOptions {
+    std::string data;
+    std::string algo = "fpgrowth";
+    double support_pct = 1.0;
+    int min_count = 0;
+    int top_k = 0;
+    unsigned threads = 0;
+    std::string out = "-";
+    std::string format = "ndjson";
+    bool help = false; // --help / -h anywhere: print usage and exit successfully
+};
+
+// Returns false (after printing why) on any unknown flag or bad value.
+// A help request stops parsing and sets opt.help.
+bool parse_batch_args(int argc, char* argv[], BatchOptions& opt) {
+    int first = 1;
+    if (argc > 1 && argv[1][0] != '-') {
+        opt.data = argv[1]; // leading bare path, e.g. draft-doctor data.csv --algo lcm
+        first = 2;
+    }
+    for (int i = first; i < argc; ++i) {
+        std::string flag = argv[i];
+        if (flag == "--help" || flag == "-h") {
+            opt.help = true;
+            return true;
+        }
+        if (i + 1 >= argc) {
+            std::cerr << "Missing value for " << flag << "\n";
+            return false;
+        }
+        std::string val = argv[++i];
+        try {
+            if (flag == "--data") opt.data = val;
+            else if (flag == "--algo") opt.algo = val;
+            else if (flag == "--support") opt.support_pct = std::stod(val);
+            else if (flag == "--min-count") opt.min_count = std::stoi(val);
+            else if (flag == "--top-k") opt.top_k = std::stoi(val);
+            else if (flag == "--threads") opt.threads = (unsigned)std::stoul(val);
+            else if (flag == "--out") opt.out = val;
+            else if (flag == "--format") opt.format = val;
+            else {
+                std::cerr << "Unknown option: " << flag << "\n";
+                return false;
+            }
+        } catch (const std::exception&) {
+            std::cerr << "Bad value for " << flag << ": " << val << "\n";
+            return false;
+        }
+    }
+    if (opt.data.empty()) {
+        std::cerr << "--data is required\n";
+        return false;
+    }
+    if (opt.format != "ndjson" && opt.format != "bin") {
+        std::cerr << "Unknown format: " << opt.format << "\n";
+        return false;
+    }
+    return true;
+}
+
+int run_batch(int argc, char* argv[]) {
+    BatchOptions opt;
+    if (!parse_batch_args(argc, argv, opt)) {
+        print_usage();
+        return 2;
+    }
+    if (opt.help) {
+        print_usage();
+        return 0;
+    }
+
+    DataLoader loader;
+    if (!loader.load_data(opt.data)) return 1;
+    const auto& transactions = loader.get_transactions();
+
+    static const std::vector<std::string> algos = { "apriori", "fpgrowth", "lcm", "lcm-closed", "sampling", "prefixspan" };
+    if (std::find(algos.begin(), algos.end(), opt.algo) == algos.end()) {
+        std::cerr << "Unknown algorithm: " << opt.algo << "\n";
+        print_usage();
+        return 2;
+    }
+
+    std::vector<Pattern> patterns;
+    std::vector<SequencePattern> sequences;
+    bool sequential = opt.algo == "prefixspan";
+
+    // One mining run at 'min_sup'; returns how many patterns it found
+    auto mine = [&](int min_sup) -> size_t {
+        if (opt.algo == "apriori") {
+            Apriori miner;
+            patterns = miner.run(transactions, min_sup);
+        } else if (opt.algo == "fpgrowth") {
+            FPGrowth miner(opt.threads);
+            patterns = miner.run(transactions, min_sup);
+        } else if (opt.algo == "lcm") {
+            LCM miner;
+            patterns = miner.run(transactions, min_sup);
+        } else if (opt.algo == "lcm-closed") {
+            LCM miner(LCM::Mode::Closed);
+            patterns = miner.run(transactions, min_sup);
+        } else if (opt.algo == "sampling") {
+            SamplingMiner miner(20000, 0.8, 42, opt.threads); // default sample size, slack and seed
+            patterns = miner.run(transactions, min_sup);
+        } else {
+            PrefixSpan miner;
+            sequences = miner.run(loader.get_sequences(), min_sup);
+        }
+        return sequential ? sequences.size() : patterns.size();
+    };
+
+    int min_sup;
+    if (opt.top_k > 0) min_sup = top_k_threshold(transactions, opt.top_k);
+    else if (opt.min_count > 0) min_sup = opt.min_count;
+    else min_sup = (int)(transactions.size() * (opt.support_pct / 100.0));
+    if (min_sup < 1) min_sup = 1;
+
+    auto start = std::chrono::high_resolution_clock::now();
+    if (opt.top_k > 0) {
+        // Re-mines at lower supports if the first guess leaves fewer than K
+        min_sup = mine_top_k(min_sup, opt.top_k, mine);
+        // Always ranked, even when fewer than K patterns came back
+        rank_top_k(patterns, opt.top_k);
+        rank_top_k(sequences, opt.top_k);
+    } else {
+        mine(min_sup);
+    }
+    auto end = std::chrono::high_resolution_clock::now();
+    std::chrono::duration<double, std::milli> elapsed = end - start;
+
+    NameTable names(loader);
+    std::ofstream file;
+    std::ostream* out = &std::cout;
+    if (opt.out != "-") {
+        file.open(opt.out, std::ios::binary);
+        if (!file.is_open()) {
+            std::cerr << "Error: Could not open " << opt.out << " for writing\n";
+            return 1;
+        }
+        out = &file;
+    }
+
+    if (sequential) {
+        if (opt.format == "bin") write_binary(sequences, names, *out);
+        else write_ndjson(sequences, names, *out);
+    } else {
+        if (opt.format == "bin") write_binary(patterns, names, *out);
+        else write_ndjson(patterns, names, *out);
+    }
+
+    // Summary goes to stderr so stdout stays machine-readable
+    size_t found = sequential ? sequences.size() : patterns.size();
+    std::cerr << opt.algo << ": " << found << " patterns (MinSup " << min_sup << ") in "
+              << elapsed.count() << " ms from " << transactions.size() << " transactions\n";
+    return out->good() ? 0 : 1;
+}
+
 int main(int argc, char* argv[]) {
+    // Any --flag or -h (in any position) switches to batch mode; a bare path alone keeps the
+    // interactive menu
+    if (argc > 1 && (std::strcmp(argv[1], "-h") == 0 || std::strcmp(argv[1], "--help") == 0)) {
+        print_usage();
+        return 0;
+    }
+    for (int i = 1; i < argc; ++i) {
+        if (std::strncmp(argv[i], "--", 2) == 0 || std::strcmp(argv[i], "-h") == 0) return run_batch(argc, argv);
+    }
+    if (argc > 2) {
+        std::cerr << "Unexpected argument: " << argv[2] << "\n";
+        print_usage();
+        return 2;
+    }
+
     DataLoader loader;
     std::string filename;
     print_header();
@@ -136,16 +423,19 @@ int main(int argc, char* argv[]) {
     }
 
     int choice = 0;
-    while (choice != 5) {
+    while (choice != 7) {
         std::cout << "\n--- MAIN MENU ---\n";
         std::cout << "1. Load Data File\n";
         std::cout << "2. Run Apriori Mining\n";
         std::cout << "3. Run FP-Growth Mining\n";
-        std::cout << "4. RACE: Apriori vs FP-Growth\n";
-        std::cout << "5. Exit\n";
+        std::cout << "4. RACE: Apriori vs FP-Growth vs LCM\n";
+        std::cout << "5. Run Sampling Mining (fast, verified)\n";
+        std::cout << "6. Run PrefixSpan (draft order)\n";
+        std::cout << "7. Exit\n";
         std::cout << "Select: ";
         
         if (!(std::cin >> choice)) {
+            if (std::cin.eof()) break; // stdin closed, no choice will ever come
             std::cin.clear(); 
             std::cin.ignore(10000, '\n'); 
             continue;
@@ -165,7 +455,9 @@ int main(int argc, char* argv[]) {
             case 2: run_apriori(loader); break;
             case 3: run_fpgrowth(loader); break;
             case 4: run_race(loader); break;
-            case 5: break;
+            case 5: run_sampling(loader); break;
+            case 6: run_prefixspan(loader); break;
+            case 7: break;
             default: std::cout << "Invalid.\n";
         }
     }
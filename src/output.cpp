@@ -0,0 +1,139 @@
+#include "output.hpp"
+#include <charconv>
+#include <cstdint>
+#include <cstring>
+#include <cstdio>
+
+// Flush the staging buffer once it gets this big (keeps memory flat on huge result sets)
+static const size_t FLUSH_BYTES = 1 << 20;
+
+static std::string json_escape(const std::string& s) {
+    std::string out = "\"";
+    for (char c : s) {
+        switch (c) {
+            case '"':  out += "\\\""; break;
+            case '\\': out += "\\\\"; break;
+            case '\n': out += "\\n"; break;
+            case '\r': out += "\\r"; break;
+            case '\t': out += "\\t"; break;
+            default:
+                if ((unsigned char)c < 0x20) {
+                    char hex[8];
+                    std::snprintf(hex, sizeof(hex), "\\u%04x", (unsigned char)c);
+                    out += hex;
+                } else {
+                    out += c;
+                }
+        }
+    }
+    out += "\"";
+    return out;
+}
+
+static void append_int(std::string& buf, long long v) {
+    char tmp[24];
+    auto res = std::to_chars(tmp, tmp + sizeof(tmp), v);
+    buf.append(tmp, res.ptr);
+}
+
+template <typename T>
+static void append_raw(std::string& buf, T v) {
+    char tmp[sizeof(T)];
+    std::memcpy(tmp, &v, sizeof(T)); // host order; all supported targets are little-endian
+    buf.append(tmp, sizeof(T));
+}
+
+NameTable::NameTable(const DataLoader& loader) : names(loader.get_name_table()) {
+    json_names.reserve(names.size());
+    for (const auto& n : names) json_names.push_back(json_escape(n));
+}
+
+const std::string& NameTable::name(int id) const {
+    if (id >= 0 && id < (int)names.size()) return names[id];
+    return names[0];
+}
+
+const std::string& NameTable::json(int id) const {
+    if (id >= 0 && id < (int)json_names.size()) return json_names[id];
+    return json_names[0];
+}
+
+// Itemsets and sequences share the writers; only the item container differs
+template <typename P>
+static void write_ndjson_impl(const std::vector<P>& patterns, const NameTable& names, std::ostream& out) {
+    std::string buf;
+    buf.reserve(FLUSH_BYTES + 4096);
+
+    for (const auto& p : patterns) {
+        buf += "{\"support\":";
+        append_int(buf, p.support);
+        buf += ",\"ids\":[";
+        bool first = true;
+        for (int id : p.items) {
+            if (!first) buf += ',';
+            append_int(buf, id);
+            first = false;
+        }
+        buf += "],\"names\":[";
+        first = true;
+        for (int id : p.items) {
+            if (!first) buf += ',';
+            buf += names.json(id);
+            first = false;
+        }
+        buf += "]}\n";
+
+        if (buf.size() >= FLUSH_BYTES) {
+            out.write(buf.data(), buf.size());
+            buf.clear();
+        }
+    }
+    out.write(buf.data(), buf.size());
+    out.flush();
+}
+
+template <typename P>
+static void write_binary_impl(const std::vector<P>& patterns, const NameTable& names, std::ostream& out,
+                              const char* magic) {
+    std::string buf;
+    buf.reserve(FLUSH_BYTES + 4096);
+
+    buf.append(magic, 4);
+    append_raw<uint32_t>(buf, 1);
+    append_raw<uint32_t>(buf, (uint32_t)names.size());
+    for (size_t id = 0; id < names.size(); ++id) {
+        const std::string& n = names.name((int)id);
+        append_raw<uint16_t>(buf, (uint16_t)n.size());
+        buf += n;
+    }
+    append_raw<uint64_t>(buf, (uint64_t)patterns.size());
+
+    for (const auto& p : patterns) {
+        append_raw<uint32_t>(buf, (uint32_t)p.support);
+        append_raw<uint16_t>(buf, (uint16_t)p.items.size());
+        for (int id : p.items) append_raw<uint32_t>(buf, (uint32_t)id);
+
+        if (buf.size() >= FLUSH_BYTES) {
+            out.write(buf.data(), buf.size());
+            buf.clear();
+        }
+    }
+    out.write(buf.data(), buf.size());
+    out.flush();
+}
+
+void write_ndjson(const std::vector<Pattern>& patterns, const NameTable& names, std::ostream& out) {
+    write_ndjson_impl(patterns, names, out);
+}
+
+void write_ndjson(const std::vector<SequencePattern>& patterns, const NameTable& names, std::ostream& out) {
+    write_ndjson_impl(patterns, names, out);
+}
+
+void write_binary(const std::vector<Pattern>& patterns, const NameTable& names, std::ostream& out) {
+    write_binary_impl(patterns, names, out, "DDPT");
+}
+
+void write_binary(const std::vector<SequencePattern>& patterns, const NameTable& names, std::ostream& out) {
+    write_binary_impl(patterns, names, out, "DDSQ");
+}
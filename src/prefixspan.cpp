@@ -0,0 +1,92 @@
+#include "prefixspan.hpp"
+#include <algorithm>
+
+std::vector<SequencePattern> PrefixSpan::run(const std::vector<Sequence>& sequences, int min_sup_count) {
+    this->min_sup = min_sup_count;
+    frequent_patterns.clear();
+
+    // 1. Item supports (each sequence holds a champion at most once)
+    int max_id = 0;
+    for (const auto& s : sequences) {
+        for (int item : s.items) max_id = std::max(max_id, item);
+    }
+    std::vector<int> counts(max_id + 1, 0);
+    for (const auto& s : sequences) {
+        for (int item : s.items) counts[item]++;
+    }
+
+    // 2. Flatten, dropping infrequent items: they can never be part of a pattern.
+    // Sequences left empty are skipped entirely.
+    flat.clear();
+    seq_end.clear();
+    std::vector<Projection> all;
+    for (const auto& s : sequences) {
+        uint32_t start = (uint32_t)flat.size();
+        for (int item : s.items) {
+            if (counts[item] >= min_sup) flat.push_back(item);
+        }
+        if (flat.size() == start) continue;
+        all.push_back({ (uint32_t)seq_end.size(), start });
+        seq_end.push_back((uint32_t)flat.size());
+    }
+
+    seen.assign(max_id + 1, 0);
+    epoch = 0;
+
+    // 3. Grow from the empty prefix (root projection = every sequence from its start)
+    std::vector<int> prefix;
+    mine(all, prefix);
+    return frequent_patterns;
+}
+
+void PrefixSpan::mine(const std::vector<Projection>& projected, std::vector<int>& prefix) {
+    if (max_length > 0 && prefix.size() >= max_length) return;
+
+    // Pass 1: support of each item in the projected suffixes (once per sequence)
+    std::vector<int> counts(seen.size(), 0);
+    for (const auto& p : projected) {
+        epoch++;
+        for (uint32_t k = p.pos; k < seq_end[p.seq]; ++k) {
+            int item = flat[k];
+            if (seen[item] != epoch) {
+                seen[item] = epoch;
+                counts[item]++;
+            }
+        }
+    }
+
+    std::vector<int> frequent;
+    std::vector<int> slot(seen.size(), -1); // item -> index in 'frequent'
+    for (int item = 0; item < (int)counts.size(); ++item) {
+        if (counts[item] >= min_sup) {
+            slot[item] = (int)frequent.size();
+            frequent.push_back(item);
+        }
+    }
+    if (frequent.empty()) return;
+
+    // Pass 2: pseudo-project on every frequent item at once. The new suffix starts
+    // right after the item's first occurrence; used-up suffixes are dropped.
+    std::vector<std::vector<Projection>> next(frequent.size());
+    for (size_t f = 0; f < frequent.size(); ++f) next[f].reserve(counts[frequent[f]]);
+    for (const auto& p : projected) {
+        epoch++;
+        uint32_t end = seq_end[p.seq];
+        for (uint32_t k = p.pos; k < end; ++k) {
+            int item = flat[k];
+            if (slot[item] < 0 || seen[item] == epoch) continue;
+            seen[item] = epoch;
+            if (k + 1 < end) next[slot[item]].push_back({ p.seq, k + 1 });
+        }
+    }
+
+    for (size_t f = 0; f < frequent.size(); ++f) {
+        prefix.push_back(frequent[f]);
+        frequent_patterns.push_back({ prefix, counts[frequent[f]] });
+
+        if ((int)next[f].size() >= min_sup) mine(next[f], prefix);
+
+        std::vector<Projection>().swap(next[f]); // free before moving to the next sibling
+        prefix.pop_back();
+    }
+}
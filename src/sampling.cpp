@@ -0,0 +1,324 @@
+#include "sampling.hpp"
+#include "fpgrowth.hpp"
+#include <algorithm>
+#include <random>
+#include <numeric>
+#include <map>
+#include <iostream>
+#include <cstdint>
+
+namespace {
+
+// Portable popcount (std::popcount is C++20)
+inline int popcount64(uint64_t x) {
+    x = x - ((x >> 1) & 0x5555555555555555ull);
+    x = (x & 0x3333333333333333ull) + ((x >> 2) & 0x3333333333333333ull);
+    x = (x + (x >> 4)) & 0x0f0f0f0f0f0f0f0full;
+    return (int)((x * 0x0101010101010101ull) >> 56);
+}
+
+// Prefix trie over candidate itemsets (size >= 2), so candidates sharing a prefix
+// share its bitset intersection.
+struct CandidateTrie {
+    struct Node {
+        std::vector<std::pair<int, int>> children; // (item, node index), sorted by item
+        int candidate = -1;                        // index into candidates, -1 if none
+    };
+    std::vector<Node> nodes;
+
+    explicit CandidateTrie(const std::vector<std::set<int>>& candidates) {
+        nodes.emplace_back();
+        for (size_t c = 0; c < candidates.size(); ++c) {
+            int cur = 0;
+            for (int item : candidates[c]) {
+                auto& kids = nodes[cur].children;
+                auto it = std::lower_bound(kids.begin(), kids.end(), std::make_pair(item, -1));
+                if (it != kids.end() && it->first == item) {
+                    cur = it->second;
+                } else {
+                    int idx = (int)nodes.size();
+                    kids.insert(it, { item, idx });
+                    nodes.emplace_back(); // may reallocate, so 'kids' is not used after this
+                    cur = idx;
+                }
+            }
+            nodes[cur].candidate = (int)c;
+        }
+    }
+
+    // Depth-first over the trie: a node's transactions are its parent's bitset AND its
+    // item's bitset, so every shared prefix is intersected once. 'stack' holds one
+    // scratch bitset per depth.
+    void count(int node, const uint64_t* parent, size_t depth, const std::vector<std::vector<uint64_t>>& item_bits,
+               std::vector<std::vector<uint64_t>>& stack, std::vector<int>& counts) const {
+        for (const auto& [item, child] : nodes[node].children) {
+            const uint64_t* bits = item_bits[item].data();
+            if (parent) {
+                uint64_t* out = stack[depth].data();
+                size_t words = stack[depth].size();
+                int total = 0;
+                for (size_t w = 0; w < words; ++w) {
+                    out[w] = parent[w] & bits[w];
+                    total += popcount64(out[w]);
+                }
+                if (nodes[child].candidate >= 0) counts[nodes[child].candidate] = total;
+                if (total == 0) continue; // nothing below can occur either
+                bits = out;
+            }
+            if (!nodes[child].children.empty()) count(child, bits, depth + 1, item_bits, stack, counts);
+        }
+    }
+};
+
+} // namespace
+
+std::vector<Pattern> SamplingMiner::run(const std::vector<Transaction>& transactions, int min_sup_count) {
+    this->min_sup = min_sup_count;
+    report = SamplingReport{};
+    item_bits.clear();
+
+    // Small datasets: the "sample" is the whole thing, so just mine it exactly.
+    if (transactions.size() <= sample_size) {
+        report.sample_size = transactions.size();
+        report.sample_min_sup = min_sup;
+        FPGrowth exact(num_threads);
+        return exact.run(transactions, min_sup);
+    }
+
+    // Step 1: Mine the sample at a lowered, scaled threshold
+    std::vector<Transaction> sample = draw_sample(transactions);
+    double scale = (double)sample.size() / (double)transactions.size();
+    int low_sup = (int)(min_sup * scale * slack);
+    if (low_sup < 1) low_sup = 1;
+    report.sample_size = sample.size();
+    report.sample_min_sup = low_sup;
+
+    FPGrowth sample_miner(num_threads);
+    std::vector<Pattern> sample_frequent = sample_miner.run(sample, low_sup);
+
+    // Step 2: Candidates = sample-frequent itemsets (size >= 2) + their negative border.
+    // Singletons are handled separately: every item is counted in the pass below,
+    // which covers the singleton part of the border, including items the sample never saw.
+    std::vector<std::set<int>> candidates;
+    for (const auto& p : sample_frequent) {
+        if (p.items.size() >= 2) candidates.push_back(p.items);
+    }
+    size_t num_sample_frequent = candidates.size();
+    std::vector<std::set<int>> border = negative_border(sample_frequent);
+    candidates.insert(candidates.end(), border.begin(), border.end());
+    report.candidates = num_sample_frequent;
+
+    // Step 3: One pass over the full data for singletons and pairs, bitsets for the rest
+    std::vector<int> single_counts;
+    std::vector<int> counts = count_supports(transactions, candidates, single_counts);
+
+    std::set<int> sample_singles;
+    for (const auto& p : sample_frequent) {
+        if (p.items.size() == 1) sample_singles.insert(*p.items.begin());
+    }
+
+    // Border check: any frequent border itemset means something above it might be missing
+    std::vector<Pattern> result;
+    for (int item = 0; item < (int)single_counts.size(); ++item) {
+        int c = single_counts[item];
+        if (c == 0) continue;
+        if (sample_singles.count(item) == 0) {
+            report.border_size++;
+            if (c >= min_sup) report.border_failures++;
+        }
+        if (c >= min_sup) result.push_back({ { item }, c });
+    }
+    for (size_t i = 0; i < candidates.size(); ++i) {
+        if (i >= num_sample_frequent) {
+            report.border_size++;
+            if (counts[i] >= min_sup) report.border_failures++;
+        }
+        if (counts[i] >= min_sup) result.push_back({ candidates[i], counts[i] });
+    }
+
+    // Second pass(es): a frequent border itemset can hide frequent supersets, but only
+    // ones on the border of what is now known to be frequent. Count just those by bitset
+    // intersection until no new border itemset turns out frequent.
+    std::set<std::vector<int>> counted;
+    for (const auto& c : candidates) counted.insert({ c.begin(), c.end() });
+    size_t misses = report.border_failures;
+    while (misses > 0) {
+        std::vector<std::set<int>> next;
+        for (auto& b : negative_border(result)) {
+            if (counted.insert({ b.begin(), b.end() }).second) next.push_back(b);
+        }
+        if (next.empty()) break;
+
+        report.extra_passes++;
+        report.border_size += next.size();
+        build_item_bits(transactions, next);
+        std::vector<int> next_counts = count_with_bits(next);
+        misses = 0;
+        for (size_t i = 0; i < next.size(); ++i) {
+            if (next_counts[i] < min_sup) continue;
+            misses++;
+            result.push_back({ next[i], next_counts[i] });
+        }
+    }
+    if (report.extra_passes > 0) {
+        std::cerr << "Sampling missed " << report.border_failures << " border itemset(s); "
+                  << report.extra_passes << " extra counting pass(es) to complete the result.\n";
+    }
+
+    item_bits.clear();
+    return result;
+}
+
+std::vector<Transaction> SamplingMiner::draw_sample(const std::vector<Transaction>& transactions) {
+    std::vector<size_t> idx(transactions.size());
+    std::iota(idx.begin(), idx.end(), 0);
+
+    std::mt19937 rng(seed);
+    size_t n = std::min(sample_size, transactions.size());
+    for (size_t i = 0; i < n; ++i) {
+        std::uniform_int_distribution<size_t> pick(i, idx.size() - 1);
+        std::swap(idx[i], idx[pick(rng)]);
+    }
+
+    // Keep original order in the sample (nicer cache behaviour, deterministic output)
+    std::sort(idx.begin(), idx.begin() + n);
+    std::vector<Transaction> sample;
+    sample.reserve(n);
+    for (size_t i = 0; i < n; ++i) sample.push_back(transactions[idx[i]]);
+    return sample;
+}
+
+std::vector<std::set<int>> SamplingMiner::negative_border(const std::vector<Pattern>& frequent) {
+    // Group sample-frequent itemsets by size, as sorted vectors for the join
+    std::map<size_t, std::vector<std::vector<int>>> levels;
+    std::set<std::vector<int>> known;
+    for (const auto& p : frequent) {
+        std::vector<int> v(p.items.begin(), p.items.end());
+        known.insert(v);
+        levels[v.size()].push_back(v);
+    }
+
+    std::vector<std::set<int>> border;
+    for (auto& [k, sets] : levels) {
+        std::sort(sets.begin(), sets.end());
+
+        // Apriori-gen join: sets sharing their first k-1 items
+        for (size_t i = 0; i < sets.size(); ++i) {
+            for (size_t j = i + 1; j < sets.size(); ++j) {
+                if (!std::equal(sets[i].begin(), sets[i].end() - 1, sets[j].begin())) break;
+
+                std::vector<int> cand = sets[i];
+                cand.push_back(sets[j].back());
+                if (known.count(cand)) continue;
+
+                // Every (k)-subset must be sample-frequent to sit on the border
+                bool all_frequent = true;
+                std::vector<int> sub(cand.size() - 1);
+                for (size_t skip = 0; skip < cand.size() && all_frequent; ++skip) {
+                    size_t w = 0;
+                    for (size_t x = 0; x < cand.size(); ++x) {
+                        if (x != skip) sub[w++] = cand[x];
+                    }
+                    if (!known.count(sub)) all_frequent = false;
+                }
+
+                if (all_frequent) border.push_back({ cand.begin(), cand.end() });
+            }
+        }
+    }
+    return border;
+}
+
+std::vector<int> SamplingMiner::count_supports(const std::vector<Transaction>& transactions,
+                                               const std::vector<std::set<int>>& candidates,
+                                               std::vector<int>& single_counts) {
+    std::vector<int> counts(candidates.size(), 0);
+
+    int max_id = 0;
+    for (const auto& t : transactions) {
+        if (!t.items.empty()) max_id = std::max(max_id, t.items.back());
+    }
+    single_counts.assign(max_id + 1, 0);
+
+    // Pairs are the bulk of the border. With a small item universe (a few hundred
+    // champions) a dense pair matrix filled during the scan is the cheapest way to count them.
+    const int dense_limit = 2048;
+    bool dense_pairs = max_id < dense_limit;
+    size_t width = (size_t)max_id + 1;
+    std::vector<int> pair_counts;
+    std::vector<std::set<int>> deep;
+    std::vector<size_t> deep_index;
+    for (size_t c = 0; c < candidates.size(); ++c) {
+        if (!dense_pairs || candidates[c].size() != 2) {
+            deep.push_back(candidates[c]);
+            deep_index.push_back(c);
+        }
+    }
+    if (dense_pairs) pair_counts.assign(width * width, 0);
+
+    for (const auto& t : transactions) {
+        const auto& items = t.items;
+        for (size_t i = 0; i < items.size(); ++i) {
+            single_counts[items[i]]++;
+            if (dense_pairs) {
+                int* row = &pair_counts[items[i] * width];
+                for (size_t j = i + 1; j < items.size(); ++j) row[items[j]]++;
+            }
+        }
+    }
+
+    // Larger itemsets: intersect per-item transaction bitsets
+    if (!deep.empty()) {
+        build_item_bits(transactions, deep);
+        std::vector<int> deep_counts = count_with_bits(deep);
+        for (size_t d = 0; d < deep.size(); ++d) counts[deep_index[d]] = deep_counts[d];
+    }
+    if (dense_pairs) {
+        for (size_t c = 0; c < candidates.size(); ++c) {
+            if (candidates[c].size() != 2) continue;
+            int a = *candidates[c].begin();
+            int b = *candidates[c].rbegin();
+            counts[c] = pair_counts[a * width + b];
+        }
+    }
+    return counts;
+}
+
+void SamplingMiner::build_item_bits(const std::vector<Transaction>& transactions,
+                                    const std::vector<std::set<int>>& candidates) {
+    size_t words = (transactions.size() + 63) / 64;
+    std::vector<int> missing;
+    for (const auto& c : candidates) {
+        for (int item : c) {
+            if (item >= (int)item_bits.size()) item_bits.resize(item + 1);
+            if (item_bits[item].empty()) {
+                item_bits[item].assign(words, 0);
+                missing.push_back(item);
+            }
+        }
+    }
+    if (missing.empty()) return;
+
+    std::vector<char> wanted(item_bits.size(), 0);
+    for (int item : missing) wanted[item] = 1;
+    for (size_t t = 0; t < transactions.size(); ++t) {
+        for (int item : transactions[t].items) {
+            if (item < (int)wanted.size() && wanted[item]) item_bits[item][t / 64] |= uint64_t(1) << (t % 64);
+        }
+    }
+}
+
+std::vector<int> SamplingMiner::count_with_bits(const std::vector<std::set<int>>& candidates) {
+    std::vector<int> counts(candidates.size(), 0);
+    size_t max_len = 0;
+    size_t words = 0;
+    for (const auto& c : candidates) {
+        max_len = std::max(max_len, c.size());
+        words = std::max(words, item_bits[*c.begin()].size());
+    }
+
+    CandidateTrie trie(candidates);
+    std::vector<std::vector<uint64_t>> stack(max_len + 1, std::vector<uint64_t>(words));
+    trie.count(0, nullptr, 0, item_bits, stack, counts);
+    return counts;
+}
@@ -0,0 +1,24 @@
+#include "topk.hpp"
+#include <map>
+
+int top_k_threshold(const std::vector<Transaction>& transactions, int k) {
+    std::map<int, int> counts;
+    for (const auto& t : transactions) {
+        for (int item : t.items) counts[item]++;
+    }
+    std::vector<int> sorted;
+    for (auto const& [item, c] : counts) sorted.push_back(c);
+    std::sort(sorted.begin(), sorted.end(), std::greater<int>());
+    if (sorted.empty()) return 1;
+    return sorted[std::min<size_t>(k, sorted.size()) - 1];
+}
+
+int mine_top_k(int start, int k, const std::function<size_t(int)>& mine) {
+    int min_sup = std::max(1, start);
+    size_t found = mine(min_sup);
+    while (found < (size_t)k && min_sup > 1) {
+        min_sup = std::max(1, min_sup / 2);
+        found = mine(min_sup);
+    }
+    return min_sup;
+}
@@ -27,13 +27,24 @@ std::string DataLoader::get_champion_name(int id) const {
     return "Unknown";
 }
 
+std::vector<std::string> DataLoader::get_name_table() const {
+    std::vector<std::string> names(next_id, "Unknown");
+    for (auto const& [id, name] : id_to_name) names[id] = name;
+    return names;
+}
+
 const std::vector<Transaction>& DataLoader::get_transactions() const {
     return transactions;
 }
 
+const std::vector<Sequence>& DataLoader::get_sequences() const {
+    return sequences;
+}
+
 bool DataLoader::load_data(const std::string& file_path) {
     // Reset previous state so each load starts fresh
     transactions.clear();
+    sequences.clear();
     name_to_id.clear();
     id_to_name.clear();
     next_id = 1;
@@ -79,11 +90,14 @@ bool DataLoader::load_data(const std::string& file_path) {
         }
 
         std::set<int> unique_items;
+        Sequence seq;
         for (int idx : target_indices) {
             if (idx < row_data.size()) {
                 std::string val = row_data[idx];
                 if (!val.empty() && val != "None") {
-                    unique_items.insert(get_champion_id(val));
+                    int id = get_champion_id(val);
+                    // Keep column order for the sequence, first occurrence only
+                    if (unique_items.insert(id).second) seq.items.push_back(id);
                 }
             }
         }
@@ -92,6 +106,7 @@ bool DataLoader::load_data(const std::string& file_path) {
             Transaction t;
             t.items.assign(unique_items.begin(), unique_items.end());
             transactions.push_back(t);
+            sequences.push_back(std::move(seq));
         }
     }
     return true;
@@ -0,0 +1,221 @@
+#include <catch2/catch_test_macros.hpp>
+#include "fpgrowth.hpp"
+#include "lcm.hpp"
+#include "prefixspan.hpp"
+#include "sampling.hpp"
+#include "topk.hpp"
+#include <algorithm>
+#include <map>
+#include <random>
+
+// --- Helpers ---
+
+// Synthetic team rows: 'width' distinct champions per row, skewed towards low IDs
+// so there are plenty of frequent (and overlapping) itemsets.
+static std::vector<Transaction> random_transactions(int count, int num_champs, int width, unsigned seed) {
+    std::mt19937 rng(seed);
+    std::vector<double> weights;
+    for (int c = 1; c <= num_champs; ++c) weights.push_back(1.0 / c);
+    std::discrete_distribution<int> champ_dist(weights.begin(), weights.end());
+
+    std::vector<Transaction> transactions;
+    for (int i = 0; i < count; ++i) {
+        std::set<int> row;
+        while ((int)row.size() < width) row.insert(champ_dist(rng) + 1);
+        transactions.push_back({ std::vector<int>(row.begin(), row.end()) });
+    }
+    return transactions;
+}
+
+using Canonical = std::vector<std::pair<std::vector<int>, int>>;
+
+// Order-independent form of a result set
+static Canonical canonical(const std::vector<Pattern>& patterns) {
+    Canonical out;
+    for (const auto& p : patterns) out.push_back({ std::vector<int>(p.items.begin(), p.items.end()), p.support });
+    std::sort(out.begin(), out.end());
+    return out;
+}
+
+// Closed itemsets straight from the definition: no proper superset has the same support
+static Canonical closed_only(const std::vector<Pattern>& all) {
+    std::vector<Pattern> closed;
+    for (const auto& p : all) {
+        bool is_closed = true;
+        for (const auto& q : all) {
+            if (q.support == p.support && q.items.size() > p.items.size() &&
+                std::includes(q.items.begin(), q.items.end(), p.items.begin(), p.items.end())) {
+                is_closed = false;
+                break;
+            }
+        }
+        if (is_closed) closed.push_back(p);
+    }
+    return canonical(closed);
+}
+
+// --- FP-Growth ---
+
+TEST_CASE("Threaded FP-tree build gives the same result as a serial one", "[fpgrowth]") {
+    // Above the 50,000-transaction cutoff, so FPGrowth(4) really builds in parallel.
+    // One champion in every row also forces the heavy-subtree split.
+    auto transactions = random_transactions(60000, 40, 10, 5);
+    for (auto& t : transactions) {
+        if (t.items.front() != 1) t.items.insert(t.items.begin(), 1);
+    }
+
+    FPGrowth serial(1);
+    FPGrowth parallel(4);
+    auto expected = canonical(serial.run(transactions, 3000));
+    auto actual = canonical(parallel.run(transactions, 3000));
+    REQUIRE(expected.size() > 100);
+    CHECK(actual == expected);
+}
+
+// --- LCM ---
+
+TEST_CASE("LCM All mode matches FP-Growth", "[lcm]") {
+    auto transactions = random_transactions(2000, 40, 10, 7);
+
+    for (int min_sup : { 20, 60, 200 }) {
+        FPGrowth fp(1);
+        LCM lcm(LCM::Mode::All);
+        auto expected = canonical(fp.run(transactions, min_sup));
+        auto actual = canonical(lcm.run(transactions, min_sup));
+        REQUIRE(!expected.empty());
+        CHECK(actual == expected);
+    }
+}
+
+TEST_CASE("LCM Closed mode returns exactly the closed itemsets", "[lcm]") {
+    auto transactions = random_transactions(500, 30, 8, 11);
+    // Some identical rows and a champion in every row, so closures are non-trivial
+    for (int i = 0; i < 50; ++i) transactions.push_back(transactions[i]);
+    for (auto& t : transactions) {
+        if (t.items.front() != 1) t.items.insert(t.items.begin(), 1);
+    }
+
+    for (int min_sup : { 10, 40 }) {
+        FPGrowth fp(1);
+        LCM lcm(LCM::Mode::Closed);
+        auto expected = closed_only(fp.run(transactions, min_sup));
+        auto actual = canonical(lcm.run(transactions, min_sup));
+        REQUIRE(!expected.empty());
+        CHECK(actual == expected);
+    }
+}
+
+// --- Sampling ---
+
+TEST_CASE("Sampling result is exact, including after border misses", "[sampling]") {
+    auto transactions = random_transactions(3000, 40, 10, 3);
+
+    for (int min_sup : { 30, 150 }) {
+        FPGrowth fp(1);
+        auto expected = canonical(fp.run(transactions, min_sup));
+
+        // Regular run, and a tiny sample with slack > 1 that is bound to miss
+        SamplingMiner regular(1000);
+        SamplingMiner missing(100, 1.3, 5);
+        CHECK(canonical(regular.run(transactions, min_sup)) == expected);
+        CHECK(canonical(missing.run(transactions, min_sup)) == expected);
+        CHECK(missing.get_last_report().extra_passes > 0);
+    }
+}
+
+// --- PrefixSpan ---
+
+TEST_CASE("PrefixSpan matches brute-force subsequence counting", "[prefixspan]") {
+    // Short draft-like sequences: distinct champions in column order
+    std::mt19937 rng(13);
+    std::vector<Sequence> sequences;
+    for (int i = 0; i < 400; ++i) {
+        std::vector<int> pool = { 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12 };
+        std::shuffle(pool.begin(), pool.end(), rng);
+        pool.resize(3 + i % 5);
+        sequences.push_back({ pool });
+    }
+
+    // Every distinct subsequence of every sequence, counted once per sequence
+    std::map<std::vector<int>, int> brute;
+    for (const auto& s : sequences) {
+        size_t n = s.items.size();
+        for (unsigned mask = 1; mask < (1u << n); ++mask) {
+            std::vector<int> sub;
+            for (size_t k = 0; k < n; ++k) {
+                if (mask & (1u << k)) sub.push_back(s.items[k]);
+            }
+            brute[sub]++; // items are distinct, so each mask is a different subsequence
+        }
+    }
+
+    for (int min_sup : { 4, 15, 60 }) {
+        Canonical expected;
+        for (const auto& [items, count] : brute) {
+            if (count >= min_sup) expected.push_back({ items, count });
+        }
+
+        PrefixSpan miner;
+        Canonical actual;
+        for (const auto& p : miner.run(sequences, min_sup)) actual.push_back({ p.items, p.support });
+        std::sort(actual.begin(), actual.end());
+
+        REQUIRE(!expected.empty());
+        CHECK(actual == expected);
+    }
+}
+
+// --- Top-K ---
+
+TEST_CASE("Top-K is exact when K exceeds the number of champions", "[topk]") {
+    // 6 of 12 champions per row, uniformly: at the single-item guess only the 12
+    // singletons are frequent, so reaching K = 100 takes lower supports
+    std::mt19937 rng(17);
+    std::vector<Transaction> transactions;
+    std::vector<Sequence> sequences;
+    for (int i = 0; i < 3000; ++i) {
+        std::vector<int> pool = { 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12 };
+        std::shuffle(pool.begin(), pool.end(), rng);
+        pool.resize(6);
+        sequences.push_back({ pool });
+        std::sort(pool.begin(), pool.end());
+        transactions.push_back({ pool });
+    }
+    const int k = 100;
+    int start = top_k_threshold(transactions, k);
+
+    SECTION("itemsets") {
+        LCM miner;
+        std::vector<Pattern> patterns;
+        int min_sup = mine_top_k(start, k, [&](int sup) {
+            patterns = miner.run(transactions, sup);
+            return patterns.size();
+        });
+        CHECK(miner.run(transactions, start).size() < (size_t)k); // the guess alone is not enough
+        CHECK(min_sup < start);
+        rank_top_k(patterns, k);
+
+        auto expected = miner.run(transactions, 1);
+        rank_top_k(expected, k);
+        REQUIRE(patterns.size() == (size_t)k);
+        CHECK(canonical(patterns) == canonical(expected));
+    }
+
+    SECTION("sequences") {
+        PrefixSpan miner;
+        std::vector<SequencePattern> patterns;
+        mine_top_k(start, k, [&](int sup) {
+            patterns = miner.run(sequences, sup);
+            return patterns.size();
+        });
+        rank_top_k(patterns, k);
+
+        auto expected = miner.run(sequences, 1);
+        rank_top_k(expected, k);
+        REQUIRE(patterns.size() == (size_t)k);
+        for (size_t i = 0; i < patterns.size(); ++i) {
+            CHECK(patterns[i].items == expected[i].items);
+            CHECK(patterns[i].support == expected[i].support);
+        }
+    }
+}